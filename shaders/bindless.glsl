@@ -0,0 +1,26 @@
+// global descriptor tables, mirrors src/vulkan_bindless.jai
+#extension GL_EXT_nonuniform_qualifier : require
+
+#define BINDLESS_MATERIAL_BUFFER 0
+
+layout(set = 0, binding = 0) uniform sampler2D bindless_textures[];
+
+struct Material {
+    vec4 base_color;
+    uint base_color_texture;
+    uint normal_texture;
+    float roughness;
+    float metallic;
+};
+
+layout(std430, set = 0, binding = 1) readonly buffer MaterialBuffer {
+    Material materials[];
+} bindless_material_buffers[];
+
+Material bindless_material(uint material_index) {
+    return bindless_material_buffers[BINDLESS_MATERIAL_BUFFER].materials[material_index];
+}
+
+vec4 bindless_sample(uint texture_index, vec2 uv) {
+    return texture(bindless_textures[nonuniformEXT(texture_index)], uv);
+}
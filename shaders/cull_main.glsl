@@ -0,0 +1,96 @@
+// body of the culling compute shaders, included once with CULL_OCCLUSION 0 and once with 1. the frustum only
+// variant does not touch the pyramid, so it can run before the first pyramid has been built
+layout(local_size_x = 64) in;
+
+#if CULL_OCCLUSION
+layout(set = 1, binding = 0) uniform sampler2D hiz;
+#endif
+
+bool sphere_in_frustum(mat4 m, vec3 center, float radius) {
+    vec4 row0 = vec4(m[0][0], m[1][0], m[2][0], m[3][0]);
+    vec4 row1 = vec4(m[0][1], m[1][1], m[2][1], m[3][1]);
+    vec4 row2 = vec4(m[0][2], m[1][2], m[2][2], m[3][2]);
+    vec4 row3 = vec4(m[0][3], m[1][3], m[2][3], m[3][3]);
+
+    // clip space depth runs from 0 to 1, so the near plane is row2 on its own
+    vec4 planes[6] = vec4[6](row3 + row0, row3 - row0, row3 + row1, row3 - row1, row2, row3 - row2);
+    for (int i = 0; i < 6; i++) {
+        vec4 plane = planes[i] / length(planes[i].xyz);
+        if (dot(plane.xyz, center) + plane.w < -radius)
+            return false;
+    }
+    return true;
+}
+
+#if CULL_OCCLUSION
+// projects the sphere's bounding box with the camera the pyramid was built from and compares its nearest depth
+// against the farthest depth the pyramid stores over the covered texels
+bool sphere_occluded(CullParams params, vec3 center, float radius) {
+    vec2 uv_min = vec2(1.0);
+    vec2 uv_max = vec2(0.0);
+    float nearest = 1.0;
+
+    for (int i = 0; i < 8; i++) {
+        vec3 corner = center + radius * vec3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0,
+                                             (i & 4) != 0 ? 1.0 : -1.0);
+        vec4 clip = params.hiz_view_projection * vec4(corner, 1.0);
+        // crosses the near plane, the projection is meaningless so keep it
+        if (clip.w <= 0.0)
+            return false;
+
+        vec3 ndc = clip.xyz / clip.w;
+        vec2 uv = ndc.xy * 0.5 + 0.5;
+        uv_min = min(uv_min, uv);
+        uv_max = max(uv_max, uv);
+        nearest = min(nearest, ndc.z);
+    }
+
+    uv_min = clamp(uv_min, 0.0, 1.0);
+    uv_max = clamp(uv_max, 0.0, 1.0);
+
+    // pick the mip where the box covers at most 2x2 texels, four taps then cover all of it
+    vec2 size = (uv_max - uv_min) * params.hiz_size;
+    float mip = ceil(log2(max(max(size.x, size.y), 1.0)));
+    mip = clamp(mip, 0.0, float(params.hiz_mip_count - 1));
+
+    float farthest = max(max(textureLod(hiz, vec2(uv_min.x, uv_min.y), mip).r,
+                             textureLod(hiz, vec2(uv_max.x, uv_min.y), mip).r),
+                         max(textureLod(hiz, vec2(uv_min.x, uv_max.y), mip).r,
+                             textureLod(hiz, vec2(uv_max.x, uv_max.y), mip).r));
+    return nearest > farthest;
+}
+#endif
+
+void main() {
+    CullParams params = bindless_cull_params_buffers[cull.params_buffer_index].params;
+
+    uint instance_index = gl_GlobalInvocationID.x;
+    if (instance_index >= params.instance_count)
+        return;
+
+    InstanceData instance = bindless_instance_buffers[params.instance_buffer_index].instances[instance_index];
+    vec4 bounds = params.mesh_bounds[instance.mesh_index];
+
+    vec4 local_center = vec4(bounds.xyz, 1.0);
+    vec3 center = vec3(dot(instance.rows[0], local_center), dot(instance.rows[1], local_center),
+                       dot(instance.rows[2], local_center));
+    // the largest axis scale of the transform keeps the sphere conservative under non uniform scale
+    vec3 axis_x = vec3(instance.rows[0].x, instance.rows[1].x, instance.rows[2].x);
+    vec3 axis_y = vec3(instance.rows[0].y, instance.rows[1].y, instance.rows[2].y);
+    vec3 axis_z = vec3(instance.rows[0].z, instance.rows[1].z, instance.rows[2].z);
+    float radius = bounds.w * sqrt(max(max(dot(axis_x, axis_x), dot(axis_y, axis_y)), dot(axis_z, axis_z)));
+
+    if (!sphere_in_frustum(params.view_projection, center, radius))
+        return;
+
+#if CULL_OCCLUSION
+    if (sphere_occluded(params, center, radius))
+        return;
+#endif
+
+    uint word = CULL_INDIRECT_COMMANDS_WORD + instance.mesh_index * CULL_INDIRECT_COMMAND_WORDS +
+        CULL_INDIRECT_INSTANCE_COUNT_WORD;
+    uint slot = atomicAdd(bindless_indirect_buffers[params.indirect_buffer_index].words[word], 1);
+    bindless_visible_instance_outputs[params.visible_buffer_index].visible_instances[
+        params.mesh_first_instance[instance.mesh_index] + slot] = instance_index;
+}
@@ -0,0 +1,41 @@
+// per frame input of the culling pass, mirrors GpuCullParams in src/gpu_culling.jai
+#define CULL_MESH_COUNT 4
+
+struct CullParams {
+    // frustum of the frame being culled
+    mat4 view_projection;
+    // camera of the frame the hierarchical z pyramid was built from
+    mat4 hiz_view_projection;
+    // object space bounding sphere per mesh, xyz center and w radius
+    vec4 mesh_bounds[CULL_MESH_COUNT];
+    // first slot of each mesh in the visible instance list, matches firstInstance of its indirect command
+    uvec4 mesh_first_instance;
+    vec2 hiz_size;
+    uint hiz_mip_count;
+    uint instance_count;
+    uint instance_buffer_index;
+    uint visible_buffer_index;
+    uint indirect_buffer_index;
+    uint padding;
+};
+
+layout(std430, set = 0, binding = 1) readonly buffer CullParamsBuffer {
+    CullParams params;
+} bindless_cull_params_buffers[];
+
+layout(std430, set = 0, binding = 1) writeonly buffer VisibleInstanceOutputBuffer {
+    uint visible_instances[];
+} bindless_visible_instance_outputs[];
+
+// draw count followed by VkDrawIndexedIndirectCommand, see INSTANCING_INDIRECT_COMMANDS_OFFSET
+layout(std430, set = 0, binding = 1) buffer IndirectBuffer {
+    uint words[];
+} bindless_indirect_buffers[];
+
+#define CULL_INDIRECT_COMMANDS_WORD 4
+#define CULL_INDIRECT_COMMAND_WORDS 5
+#define CULL_INDIRECT_INSTANCE_COUNT_WORD 1
+
+layout(push_constant) uniform CullPushConstants {
+    uint params_buffer_index;
+} cull;
@@ -0,0 +1,8 @@
+// push constants of the draw passes, mirrors VulkanDrawPushConstants in src/vulkan_bindless.jai
+layout(push_constant) uniform DrawPushConstants {
+    mat4 view_projection;
+    uint material_index;
+    uint instance_buffer_index;
+    uint visible_buffer_index;
+    uint padding;
+} draw;
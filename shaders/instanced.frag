@@ -0,0 +1,23 @@
+#version 460
+#extension GL_GOOGLE_include_directive : require
+
+#include "bindless.glsl"
+
+layout(location = 0) in vec3 in_normal;
+layout(location = 1) flat in uint in_material_index;
+
+layout(location = 0) out vec4 out_color;
+
+const vec3 LIGHT_DIRECTION = vec3(0.37, 0.84, 0.4);
+const uint NO_TEXTURE = 0xffffffff;
+
+void main() {
+    Material material = bindless_material(in_material_index);
+
+    vec4 base_color = material.base_color;
+    if (material.base_color_texture != NO_TEXTURE)
+        base_color *= bindless_sample(material.base_color_texture, vec2(0.5));
+
+    float diffuse = max(dot(normalize(in_normal), LIGHT_DIRECTION), 0.0);
+    out_color = vec4(base_color.rgb * (0.25 + 0.75 * diffuse), base_color.a);
+}
@@ -0,0 +1,29 @@
+#version 460
+#extension GL_GOOGLE_include_directive : require
+
+#include "bindless.glsl"
+#include "draw.glsl"
+#include "instancing.glsl"
+
+layout(location = 0) in vec3 in_position;
+layout(location = 1) in vec3 in_normal;
+
+layout(location = 0) out vec3 out_normal;
+layout(location = 1) flat out uint out_material_index;
+
+void main() {
+    // gl_InstanceIndex starts at the mesh's range of the visible list, the culling pass filled it
+    uint instance_index =
+        bindless_visible_instance_buffers[draw.visible_buffer_index].visible_instances[gl_InstanceIndex];
+    InstanceData instance = bindless_instance_buffers[draw.instance_buffer_index].instances[instance_index];
+
+    vec4 position = vec4(in_position, 1.0);
+    vec3 world_position = vec3(dot(instance.rows[0], position), dot(instance.rows[1], position),
+                               dot(instance.rows[2], position));
+    // rows of the transform, the upper 3x3 is rotation and scale
+    mat3 basis = transpose(mat3(instance.rows[0].xyz, instance.rows[1].xyz, instance.rows[2].xyz));
+
+    out_normal = normalize(basis * in_normal);
+    out_material_index = instance.material_index;
+    gl_Position = draw.view_projection * vec4(world_position, 1.0);
+}
@@ -0,0 +1,17 @@
+// per instance data written by src/instancing.jai, mirrors InstanceData there
+struct InstanceData {
+    vec4 rows[3];
+    uint material_index;
+    uint mesh_index;
+    uint padding0;
+    uint padding1;
+};
+
+layout(std430, set = 0, binding = 1) readonly buffer InstanceBuffer {
+    InstanceData instances[];
+} bindless_instance_buffers[];
+
+// indices into the instance buffer, compacted per mesh by the culling pass
+layout(std430, set = 0, binding = 1) readonly buffer VisibleInstanceBuffer {
+    uint visible_instances[];
+} bindless_visible_instance_buffers[];